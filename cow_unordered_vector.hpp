@@ -0,0 +1,764 @@
+#ifndef COW_UNORDERED_VECTOR_HPP
+#define COW_UNORDERED_VECTOR_HPP
+
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <memory>  // std::allocator, std::allocator_traits
+#include <atomic> // std::atomic
+#include <utility> // std::move, std::forward
+#include <limits> // std::numeric_limits
+#include <algorithm> // std::find_if, std::remove_if, std::swap
+#include <stdexcept> // std::out_of_range
+#include <string> // std::to_string
+
+#include "unordered_vector.hpp"
+
+namespace xcontainer
+{
+    // An unordered_vector whose elements are shared between copies and cloned on the first mutating call.
+    // Copies are O(1) and may be read concurrently from different threads. As with any copy-on-write string,
+    // references and iterators obtained through non-const access must not be kept across a copy of the container.
+    template<typename T, class Allocator = std::allocator<T>>
+    class cow_unordered_vector
+    {
+        public:
+            // Type definitions
+            using vector_type = unordered_vector<T, Allocator>;
+            using value_type = T;
+            using allocator_type = Allocator;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = typename std::allocator_traits<Allocator>::pointer;
+            using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+            using iterator = typename vector_type::iterator;
+            using const_iterator = typename vector_type::const_iterator;
+            using reverse_iterator = typename vector_type::reverse_iterator;
+            using const_reverse_iterator = typename vector_type::const_reverse_iterator;
+
+            // Constructors
+            cow_unordered_vector() noexcept(noexcept(Allocator()))
+            {
+                m_allocator = Allocator();
+                m_buffer = nullptr;
+            }
+
+            explicit cow_unordered_vector(const Allocator& alloc) noexcept
+            {
+                m_allocator = alloc;
+                m_buffer = nullptr;
+            }
+
+            cow_unordered_vector(size_type count, const T& value, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+                m_buffer = create(vector_type(count, value, alloc));
+            }
+
+            explicit cow_unordered_vector(size_type count, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+                m_buffer = create(vector_type(count, alloc));
+            }
+
+            template<class InputItr>
+            cow_unordered_vector(InputItr first, InputItr last, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+                m_buffer = create(vector_type(first, last, alloc));
+            }
+
+            cow_unordered_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+                m_buffer = create(vector_type(init, alloc));
+            }
+
+            explicit cow_unordered_vector(vector_type&& elements)
+            {
+                m_allocator = elements.get_allocator();
+                m_buffer = create(std::move(elements));
+            }
+
+            cow_unordered_vector(const cow_unordered_vector& other) noexcept
+            {
+                m_allocator = other.m_allocator;
+                m_buffer = other.m_buffer;
+
+                acquire();
+            }
+
+            cow_unordered_vector(cow_unordered_vector&& other) noexcept
+            {
+                m_allocator = other.m_allocator;
+                m_buffer = other.m_buffer;
+
+                other.m_buffer = nullptr;
+            }
+
+            ~cow_unordered_vector()
+            {
+                release();
+            }
+
+            // Element access
+            reference at(size_type pos)
+            {
+                if(pos < size())
+                {
+                    return elements()[pos];
+                }
+                else
+                {
+                    throw std::out_of_range("pos (which is " + std::to_string(pos) + ") >= this->size() (which is " + std::to_string(size()) + ")");
+                }
+            }
+
+            const_reference at(size_type pos) const
+            {
+                if(pos < size())
+                {
+                    return m_buffer->elements[pos];
+                }
+                else
+                {
+                    throw std::out_of_range("pos (which is " + std::to_string(pos) + ") >= this->size() (which is " + std::to_string(size()) + ")");
+                }
+            }
+
+            reference operator[](size_type pos)
+            {
+                return elements()[pos];
+            }
+
+            const_reference operator[](size_type pos) const
+            {
+                return m_buffer->elements[pos];
+            }
+
+            reference front()
+            {
+                return elements().front();
+            }
+
+            const_reference front() const
+            {
+                return m_buffer->elements.front();
+            }
+
+            reference back()
+            {
+                return elements().back();
+            }
+
+            const_reference back() const
+            {
+                return m_buffer->elements.back();
+            }
+
+            // An empty container has no buffer, and only inserting an element creates one
+            T* data()
+            {
+                return (m_buffer != nullptr) ? elements().data() : nullptr;
+            }
+
+            const T* data() const noexcept
+            {
+                return (m_buffer != nullptr) ? m_buffer->elements.data() : nullptr;
+            }
+
+            // Iterators
+            iterator begin()
+            {
+                return data();
+            }
+
+            const_iterator begin() const noexcept
+            {
+                return data();
+            }
+
+            const_iterator cbegin() const noexcept
+            {
+                return data();
+            }
+
+            iterator end()
+            {
+                return (m_buffer != nullptr) ? elements().end() : nullptr;
+            }
+
+            const_iterator end() const noexcept
+            {
+                return data() + size();
+            }
+
+            const_iterator cend() const noexcept
+            {
+                return data() + size();
+            }
+
+            reverse_iterator rbegin()
+            {
+                return reverse_iterator(end());
+            }
+
+            const_reverse_iterator rbegin() const noexcept
+            {
+                return const_reverse_iterator(cend());
+            }
+
+            const_reverse_iterator crbegin() const noexcept
+            {
+                return const_reverse_iterator(cend());
+            }
+
+            reverse_iterator rend()
+            {
+                return reverse_iterator(begin());
+            }
+
+            const_reverse_iterator rend() const noexcept
+            {
+                return const_reverse_iterator(cbegin());
+            }
+
+            const_reverse_iterator crend() const noexcept
+            {
+                return const_reverse_iterator(cbegin());
+            }
+
+            // Capacity
+            [[nodiscard]] bool empty() const noexcept
+            {
+                return (size() == 0) ? true : false;
+            }
+
+            size_type size() const noexcept
+            {
+                return (m_buffer != nullptr) ? m_buffer->elements.size() : 0;
+            }
+
+            size_type max_size() const noexcept
+            {
+                return std::numeric_limits<size_type>::max();
+            }
+
+            void reserve(size_type new_cap)
+            {
+                elements().reserve(new_cap);
+            }
+
+            size_type capacity() const noexcept
+            {
+                return (m_buffer != nullptr) ? m_buffer->elements.capacity() : 0;
+            }
+
+            void shrink_to_fit()
+            {
+                if(m_buffer != nullptr)
+                {
+                    elements().shrink_to_fit();
+                }
+            }
+
+            // Number of containers sharing the elements, 0 if there are none
+            size_type use_count() const noexcept
+            {
+                return (m_buffer != nullptr) ? m_buffer->references.load(std::memory_order_acquire) : 0;
+            }
+
+            // Modifiers
+            void clear()
+            {
+                // Dropping a shared buffer is cheaper than cloning it only to clear it
+                if(use_count() > 1)
+                {
+                    release();
+                }
+                else if(m_buffer != nullptr)
+                {
+                    m_buffer->elements.clear();
+                }
+            }
+
+            iterator insert(const_iterator pos, const T& value)
+            {
+                difference_type index = pos - cbegin();
+                vector_type& owned = elements();
+
+                return owned.insert(owned.cbegin() + index, value);
+            }
+
+            iterator insert(const_iterator pos, T&& value)
+            {
+                difference_type index = pos - cbegin();
+                vector_type& owned = elements();
+
+                return owned.insert(owned.cbegin() + index, std::move(value));
+            }
+
+            iterator insert(const_iterator pos, size_type count, const T& value)
+            {
+                difference_type index = pos - cbegin();
+                vector_type& owned = elements();
+
+                return owned.insert(owned.cbegin() + index, count, value);
+            }
+
+            template<class InputItr>
+            iterator insert(const_iterator pos, InputItr first, InputItr last)
+            {
+                difference_type index = pos - cbegin();
+                vector_type& owned = elements();
+
+                return owned.insert(owned.cbegin() + index, first, last);
+            }
+
+            iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+            {
+                difference_type index = pos - cbegin();
+                vector_type& owned = elements();
+
+                return owned.insert(owned.cbegin() + index, ilist);
+            }
+
+            template< class... Args >
+            iterator emplace(const_iterator pos, Args&&... args)
+            {
+                difference_type index = pos - cbegin();
+                vector_type& owned = elements();
+
+                return owned.emplace(owned.cbegin() + index, std::forward<Args>(args)...);
+            }
+
+            iterator erase(const_iterator pos)
+            {
+                difference_type index = pos - cbegin();
+                vector_type& owned = elements();
+
+                return owned.erase(owned.cbegin() + index);
+            }
+
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                difference_type first_index = first - cbegin();
+                difference_type last_index = last - cbegin();
+                vector_type& owned = elements();
+
+                return owned.erase(owned.cbegin() + first_index, owned.cbegin() + last_index);
+            }
+
+            void push_back(const T& value)
+            {
+                elements().push_back(value);
+            }
+
+            void push_back(T&& value)
+            {
+                elements().push_back(std::move(value));
+            }
+
+            template<class... Args>
+            reference emplace_back(Args&&... args)
+            {
+                vector_type& owned = elements();
+                owned.push_back(value_type(std::forward<Args>(args)...));
+
+                return owned.back();
+            }
+
+            void pop_back()
+            {
+                elements().pop_back();
+            }
+
+            void resize(size_type count)
+            {
+                if(count == size())
+                {
+                    return;
+                }
+                else if(count == 0)
+                {
+                    clear();
+                }
+                else if(use_count() > 1 && count < size())
+                {
+                    // Copy only the elements that are kept instead of cloning the whole snapshot
+                    replace(vector_type(cbegin(), cbegin() + count, m_allocator));
+                }
+                else
+                {
+                    elements().resize(count);
+                }
+            }
+
+            void resize(size_type count, const value_type& value)
+            {
+                if(count == size())
+                {
+                    return;
+                }
+                else if(count == 0)
+                {
+                    clear();
+                }
+                else if(use_count() > 1 && count < size())
+                {
+                    replace(vector_type(cbegin(), cbegin() + count, m_allocator));
+                }
+                else
+                {
+                    elements().resize(count, value);
+                }
+            }
+
+            void swap(cow_unordered_vector& other) noexcept
+            {
+                buffer* data = m_buffer;
+                allocator_type allocator = m_allocator;
+
+                m_buffer = other.m_buffer;
+                m_allocator = other.m_allocator;
+
+                other.m_buffer = data;
+                other.m_allocator = allocator;
+            }
+
+            template<class Pred>
+            cow_unordered_vector extract_if(Pred pred)
+            {
+                // Leave a shared buffer untouched when nothing matches
+                const_iterator match = std::find_if(cbegin(), cend(), pred);
+                if(match == cend())
+                {
+                    return cow_unordered_vector(m_allocator);
+                }
+
+                // Move the matching elements to the tail, resuming after the elements find_if already tested
+                size_type index = match - cbegin();
+                vector_type& owned = elements();
+                size_type kept = owned.size() - 1;
+
+                std::swap(owned[index], owned[kept]);
+                for(size_type i = index; i < kept;)
+                {
+                    if(pred(owned[i]))
+                    {
+                        --kept;
+                        std::swap(owned[i], owned[kept]);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+
+                // Move the tail into the result with a single allocation
+                vector_type extracted(m_allocator);
+                extracted.reserve(owned.size() - kept);
+                for(size_type i = kept; i < owned.size(); ++i)
+                {
+                    extracted.push_back(std::move(owned[i]));
+                }
+
+                while(owned.size() != kept)
+                {
+                    owned.pop_back();
+                }
+
+                return cow_unordered_vector(std::move(extracted));
+            }
+
+            void merge(cow_unordered_vector&& other)
+            {
+                if(this == &other || other.m_buffer == nullptr)
+                {
+                    return;
+                }
+
+                // Adopt the other buffer outright when there is nothing to merge it into
+                if(m_buffer == nullptr)
+                {
+                    swap(other);
+                    return;
+                }
+
+                bool shared = use_count() > 1;
+                bool other_shared = other.use_count() > 1;
+
+                if(!shared && !other_shared)
+                {
+                    // Both buffers are owned, so unordered_vector can steal the larger one
+                    m_buffer->elements.merge(std::move(other.m_buffer->elements));
+                }
+                else if(shared && !other_shared && m_allocator == other.m_allocator)
+                {
+                    // This buffer has to be copied anyway, so copy it into the other one and adopt that instead
+                    append(other.m_buffer->elements, m_buffer->elements);
+
+                    release();
+                    m_buffer = other.m_buffer;
+                    other.m_buffer = nullptr;
+                }
+                else if(!shared)
+                {
+                    // Copy the other snapshot's elements without detaching it
+                    append(m_buffer->elements, other.m_buffer->elements);
+                }
+                else
+                {
+                    // Both are shared, so build the merged elements in a single allocation
+                    vector_type merged(m_allocator);
+                    grow(merged, size() + other.size());
+                    append(merged, m_buffer->elements);
+                    append(merged, other.m_buffer->elements);
+
+                    buffer* created = create(std::move(merged));
+                    release();
+                    m_buffer = created;
+                }
+            }
+
+            // Other
+            cow_unordered_vector& operator=(const cow_unordered_vector& other) noexcept
+            {
+                if(m_buffer != other.m_buffer)
+                {
+                    release();
+
+                    m_allocator = other.m_allocator;
+                    m_buffer = other.m_buffer;
+
+                    acquire();
+                }
+
+                return *this;
+            }
+
+            cow_unordered_vector& operator=(cow_unordered_vector&& other) noexcept
+            {
+                if(this != &other)
+                {
+                    release();
+
+                    m_allocator = other.m_allocator;
+                    m_buffer = other.m_buffer;
+
+                    other.m_buffer = nullptr;
+                }
+
+                return *this;
+            }
+
+            cow_unordered_vector& operator=(std::initializer_list<T> ilist)
+            {
+                // Build the new buffer first so a throwing copy leaves this container untouched
+                allocator_type allocator = Allocator();
+                buffer* created = create(vector_type(ilist, allocator));
+
+                release();
+                m_allocator = allocator;
+                m_buffer = created;
+
+                return *this;
+            }
+
+            // A shared buffer is replaced rather than cloned only to be overwritten
+            void assign(size_type count, const T& value)
+            {
+                replace(vector_type(count, value, m_allocator));
+            }
+
+            template<class InputItr>
+            void assign(InputItr first, InputItr last)
+            {
+                if(use_count() > 1)
+                {
+                    replace(vector_type(first, last, m_allocator));
+                }
+                else
+                {
+                    elements().assign(first, last);
+                }
+            }
+
+            void assign(std::initializer_list<T> ilist)
+            {
+                if(use_count() > 1)
+                {
+                    replace(vector_type(ilist, m_allocator));
+                }
+                else
+                {
+                    elements().assign(ilist);
+                }
+            }
+
+            allocator_type get_allocator() const noexcept
+            {
+                return m_allocator;
+            }
+
+        private:
+            struct buffer
+            {
+                std::atomic<size_type> references;
+                vector_type elements;
+
+                buffer(vector_type&& other) : references(1), elements(std::move(other)) {}
+                buffer(const vector_type& other) : references(1), elements(other) {}
+            };
+
+            using buffer_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<buffer>;
+            using buffer_traits = std::allocator_traits<buffer_allocator>;
+
+            buffer* m_buffer = nullptr;
+            allocator_type m_allocator = allocator_type();
+
+            template<class Elements>
+            buffer* create(Elements&& elements)
+            {
+                buffer_allocator allocator(m_allocator);
+                buffer* created = buffer_traits::allocate(allocator, 1);
+
+                try
+                {
+                    buffer_traits::construct(allocator, created, std::forward<Elements>(elements));
+                }
+                catch(...)
+                {
+                    buffer_traits::deallocate(allocator, created, 1);
+                    throw;
+                }
+
+                return created;
+            }
+
+            void acquire() noexcept
+            {
+                if(m_buffer != nullptr)
+                {
+                    m_buffer->references.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            // Drops this container's reference and leaves it without a buffer
+            void release() noexcept
+            {
+                // The last owner must observe every write made by the others before destroying the buffer
+                if(m_buffer != nullptr && m_buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    buffer_allocator allocator(m_allocator);
+
+                    buffer_traits::destroy(allocator, m_buffer);
+                    buffer_traits::deallocate(allocator, m_buffer, 1);
+                }
+
+                m_buffer = nullptr;
+            }
+
+            // Grows target to the nearest power of 2 that holds size elements, like unordered_vector does
+            static void grow(vector_type& target, size_type size)
+            {
+                if(size > target.capacity())
+                {
+                    size_type power = 1;
+                    while(power < size)
+                    {
+                        power *= 2;
+                    }
+
+                    target.reserve(power);
+                }
+            }
+
+            // Copies every element of source to the end of target, growing it at most once
+            static void append(vector_type& target, const vector_type& source)
+            {
+                grow(target, target.size() + source.size());
+
+                for(const T& value : source)
+                {
+                    target.push_back(value);
+                }
+            }
+
+            // Makes fresh the elements of this container without copying a shared buffer
+            void replace(vector_type&& fresh)
+            {
+                if(use_count() == 1)
+                {
+                    m_buffer->elements.swap(fresh);
+                }
+                else
+                {
+                    buffer* created = create(std::move(fresh));
+
+                    release();
+                    m_buffer = created;
+                }
+            }
+
+            // Returns elements owned solely by this container, cloning them if they are shared
+            vector_type& elements()
+            {
+                if(m_buffer == nullptr)
+                {
+                    m_buffer = create(vector_type(m_allocator));
+                }
+                else if(m_buffer->references.load(std::memory_order_acquire) != 1)
+                {
+                    buffer* clone = create(static_cast<const vector_type&>(m_buffer->elements));
+
+                    release();
+                    m_buffer = clone;
+                }
+
+                return m_buffer->elements;
+            }
+    };
+}
+
+namespace std
+{
+    template<class T, class Alloc, class Pred>
+    typename xcontainer::cow_unordered_vector<T, Alloc>::size_type erase_if(xcontainer::cow_unordered_vector<T, Alloc>& c, Pred pred)
+    {
+        // Leave a shared buffer untouched when nothing matches
+        auto match = std::find_if(c.cbegin(), c.cend(), pred);
+        if(match == c.cend())
+        {
+            return 0;
+        }
+
+        // Resume after the first match so no element is tested twice, then move the last kept element over it
+        auto index = match - c.cbegin();
+        auto first = c.begin() + index;
+        auto it = std::remove_if(first + 1, c.end(), pred);
+        if(it != first + 1)
+        {
+            *first = std::move(*(it - 1));
+        }
+
+        --it;
+        auto r = std::distance(it, c.end());
+        c.erase(it, c.end());
+        return r;
+    }
+
+    template<class T, class Alloc, class U>
+    typename xcontainer::cow_unordered_vector<T, Alloc>::size_type erase(xcontainer::cow_unordered_vector<T, Alloc>& c, const U& value)
+    {
+        return erase_if(c, [&value](const T& element) { return element == value; });
+    }
+
+    template<class T, class Alloc>
+    void swap(xcontainer::cow_unordered_vector<T, Alloc>& lhs, xcontainer::cow_unordered_vector<T, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
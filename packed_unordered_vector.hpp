@@ -0,0 +1,974 @@
+#ifndef PACKED_UNORDERED_VECTOR_HPP
+#define PACKED_UNORDERED_VECTOR_HPP
+
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <memory>  // std::allocator
+#include <algorithm> // std::copy, std::fill
+#include <bit> // std::popcount
+#include <compare> // std::strong_ordering
+#include <iterator> // std::random_access_iterator_tag, std::forward_iterator, std::distance
+#include <stdexcept> // std::length_error, std::out_of_range
+#include <limits> // std::numeric_limits
+#include <string> // std::to_string
+#include <type_traits> // std::conditional_t, std::is_integral_v
+#include <utility> // std::forward
+
+namespace xcontainer
+{
+    // Stores elements of Bits bits each, packed into 64-bit words. Elements never straddle two words.
+    template<unsigned Bits, class Allocator = std::allocator<std::uint64_t>>
+    class packed_unordered_vector
+    {
+        static_assert(Bits > 0 && Bits <= 32, "Bits must be in the range [1, 32]");
+        static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, std::uint64_t>, "Allocator must allocate std::uint64_t");
+
+        public:
+            // Type definitions
+            using word_type = std::uint64_t;
+            using value_type = std::conditional_t<Bits == 1, bool,
+                               std::conditional_t<Bits <= 8, std::uint8_t,
+                               std::conditional_t<Bits <= 16, std::uint16_t, std::uint32_t>>>;
+            using allocator_type = Allocator;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using const_reference = value_type;
+
+            static constexpr size_type bits_per_element = Bits;
+            static constexpr size_type elements_per_word = std::numeric_limits<word_type>::digits / Bits;
+
+            // Proxy to a single element inside a word
+            class reference
+            {
+                public:
+                    constexpr reference(word_type* word, size_type shift) noexcept : m_word(word), m_shift(shift) {}
+                    constexpr reference(const reference& other) noexcept = default;
+
+                    constexpr operator value_type() const noexcept
+                    {
+                        return static_cast<value_type>((*m_word >> m_shift) & element_mask);
+                    }
+
+                    constexpr reference& operator=(value_type value) noexcept
+                    {
+                        *m_word = (*m_word & ~(element_mask << m_shift)) | ((static_cast<word_type>(value) & element_mask) << m_shift);
+                        return *this;
+                    }
+
+                    constexpr reference& operator=(const reference& other) noexcept
+                    {
+                        return *this = static_cast<value_type>(other);
+                    }
+
+                    constexpr void flip() noexcept
+                    {
+                        *m_word ^= element_mask << m_shift;
+                    }
+
+                private:
+                    word_type* m_word;
+                    size_type m_shift;
+            };
+
+            template<bool Const>
+            class basic_iterator
+            {
+                public:
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = typename packed_unordered_vector::value_type;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = std::conditional_t<Const, value_type, typename packed_unordered_vector::reference>;
+                    using word_pointer = std::conditional_t<Const, const word_type*, word_type*>;
+
+                    constexpr basic_iterator() noexcept = default;
+
+                    constexpr basic_iterator(word_pointer words, size_type index) noexcept : m_words(words), m_index(index) {}
+
+                    template<bool OtherConst> requires (Const && !OtherConst)
+                    constexpr basic_iterator(const basic_iterator<OtherConst>& other) noexcept : m_words(other.m_words), m_index(other.m_index) {}
+
+                    constexpr reference operator*() const noexcept
+                    {
+                        if constexpr(Const)
+                        {
+                            return static_cast<value_type>((m_words[word_index(m_index)] >> word_shift(m_index)) & element_mask);
+                        }
+                        else
+                        {
+                            return reference(m_words + word_index(m_index), word_shift(m_index));
+                        }
+                    }
+
+                    constexpr reference operator[](difference_type n) const noexcept
+                    {
+                        return *(*this + n);
+                    }
+
+                    constexpr basic_iterator& operator++() noexcept
+                    {
+                        ++m_index;
+                        return *this;
+                    }
+
+                    constexpr basic_iterator operator++(int) noexcept
+                    {
+                        basic_iterator copy = *this;
+                        ++m_index;
+                        return copy;
+                    }
+
+                    constexpr basic_iterator& operator--() noexcept
+                    {
+                        --m_index;
+                        return *this;
+                    }
+
+                    constexpr basic_iterator operator--(int) noexcept
+                    {
+                        basic_iterator copy = *this;
+                        --m_index;
+                        return copy;
+                    }
+
+                    constexpr basic_iterator& operator+=(difference_type n) noexcept
+                    {
+                        m_index += n;
+                        return *this;
+                    }
+
+                    constexpr basic_iterator& operator-=(difference_type n) noexcept
+                    {
+                        m_index -= n;
+                        return *this;
+                    }
+
+                    friend constexpr basic_iterator operator+(basic_iterator itr, difference_type n) noexcept
+                    {
+                        return itr += n;
+                    }
+
+                    friend constexpr basic_iterator operator+(difference_type n, basic_iterator itr) noexcept
+                    {
+                        return itr += n;
+                    }
+
+                    friend constexpr basic_iterator operator-(basic_iterator itr, difference_type n) noexcept
+                    {
+                        return itr -= n;
+                    }
+
+                    friend constexpr difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+                    {
+                        return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index);
+                    }
+
+                    friend constexpr bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+                    {
+                        return lhs.m_index == rhs.m_index;
+                    }
+
+                    friend constexpr std::strong_ordering operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+                    {
+                        return lhs.m_index <=> rhs.m_index;
+                    }
+
+                private:
+                    friend class packed_unordered_vector;
+                    friend class basic_iterator<!Const>;
+
+                    word_pointer m_words = nullptr;
+                    size_type m_index = 0;
+            };
+
+            using iterator = basic_iterator<false>;
+            using const_iterator = basic_iterator<true>;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            // Constructors
+            constexpr packed_unordered_vector() noexcept(noexcept(Allocator()))
+            {
+                m_allocator = Allocator();
+                m_data = nullptr;
+                m_size = 0;
+                m_words = 0;
+            }
+
+            constexpr explicit packed_unordered_vector(const Allocator& alloc) noexcept
+            {
+                m_allocator = alloc;
+                m_data = nullptr;
+                m_size = 0;
+                m_words = 0;
+            }
+
+            constexpr packed_unordered_vector(size_type count, value_type value, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+
+                allocate(count);
+                m_size = count;
+                fill(value);
+            }
+
+            constexpr explicit packed_unordered_vector(size_type count, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+
+                allocate(count);
+                m_size = count;
+            }
+
+            template<class InputItr> requires (!std::is_integral_v<InputItr>)
+            constexpr packed_unordered_vector(InputItr first, InputItr last, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+
+                // Reserve once when the range can be measured without consuming it
+                if constexpr(std::forward_iterator<InputItr>)
+                {
+                    allocate(static_cast<size_type>(std::distance(first, last)));
+                }
+
+                for(InputItr itr = first; itr != last; ++itr)
+                {
+                    push_back(static_cast<value_type>(*itr));
+                }
+            }
+
+            constexpr packed_unordered_vector(std::initializer_list<value_type> init, const Allocator& alloc = Allocator())
+            {
+                m_allocator = alloc;
+
+                allocate(init.size());
+                for(value_type value : init)
+                {
+                    set(m_size++, value);
+                }
+            }
+
+            constexpr packed_unordered_vector(const packed_unordered_vector& other)
+            {
+                m_allocator = other.m_allocator;
+                m_size = other.m_size;
+                m_words = other.m_words;
+
+                m_data = (m_words != 0) ? m_allocator.allocate(m_words) : nullptr;
+                std::copy(other.m_data, other.m_data + m_words, m_data);
+            }
+
+            constexpr packed_unordered_vector(const packed_unordered_vector& other, const Allocator& alloc)
+            {
+                m_allocator = alloc;
+                m_size = other.m_size;
+                m_words = other.m_words;
+
+                m_data = (m_words != 0) ? m_allocator.allocate(m_words) : nullptr;
+                std::copy(other.m_data, other.m_data + m_words, m_data);
+            }
+
+            constexpr packed_unordered_vector(packed_unordered_vector&& other) noexcept
+            {
+                m_allocator = other.m_allocator;
+                m_size = other.m_size;
+                m_words = other.m_words;
+                m_data = other.m_data;
+
+                other.m_data = nullptr;
+                other.m_size = 0;
+                other.m_words = 0;
+            }
+
+            constexpr packed_unordered_vector(packed_unordered_vector&& other, const Allocator& alloc)
+            {
+                m_allocator = alloc;
+                m_size = other.m_size;
+                m_words = other.m_words;
+
+                if(m_allocator == other.m_allocator)
+                {
+                    m_data = other.m_data;
+
+                    other.m_data = nullptr;
+                    other.m_size = 0;
+                    other.m_words = 0;
+                }
+                else
+                {
+                    m_data = (m_words != 0) ? m_allocator.allocate(m_words) : nullptr;
+                    std::copy(other.m_data, other.m_data + m_words, m_data);
+                }
+            }
+
+            ~packed_unordered_vector()
+            {
+                if(m_data != nullptr)
+                {
+                    m_allocator.deallocate(m_data, m_words);
+                }
+            }
+
+            // Element access
+            constexpr reference at(size_type pos)
+            {
+                if(pos < m_size)
+                {
+                    return (*this)[pos];
+                }
+                else
+                {
+                    throw std::out_of_range("pos (which is " + std::to_string(pos) + ") >= this->size() (which is " + std::to_string(m_size) + ")");
+                }
+            }
+
+            constexpr const_reference at(size_type pos) const
+            {
+                if(pos < m_size)
+                {
+                    return get(pos);
+                }
+                else
+                {
+                    throw std::out_of_range("pos (which is " + std::to_string(pos) + ") >= this->size() (which is " + std::to_string(m_size) + ")");
+                }
+            }
+
+            constexpr reference operator[](size_type pos)
+            {
+                return reference(m_data + word_index(pos), word_shift(pos));
+            }
+
+            constexpr const_reference operator[](size_type pos) const
+            {
+                return get(pos);
+            }
+
+            constexpr reference front()
+            {
+                return (*this)[0];
+            }
+
+            constexpr const_reference front() const
+            {
+                return get(0);
+            }
+
+            constexpr reference back()
+            {
+                return (*this)[m_size - 1];
+            }
+
+            constexpr const_reference back() const
+            {
+                return get(m_size - 1);
+            }
+
+            // Underlying words. Bits past size() are always zero.
+            constexpr word_type* data() noexcept
+            {
+                return m_data;
+            }
+
+            constexpr const word_type* data() const noexcept
+            {
+                return m_data;
+            }
+
+            // Iterators
+            constexpr iterator begin() noexcept
+            {
+                return iterator(m_data, 0);
+            }
+
+            constexpr const_iterator begin() const noexcept
+            {
+                return const_iterator(m_data, 0);
+            }
+
+            constexpr const_iterator cbegin() const noexcept
+            {
+                return const_iterator(m_data, 0);
+            }
+
+            constexpr iterator end() noexcept
+            {
+                return iterator(m_data, m_size);
+            }
+
+            constexpr const_iterator end() const noexcept
+            {
+                return const_iterator(m_data, m_size);
+            }
+
+            constexpr const_iterator cend() const noexcept
+            {
+                return const_iterator(m_data, m_size);
+            }
+
+            constexpr reverse_iterator rbegin() noexcept
+            {
+                return reverse_iterator(end());
+            }
+
+            constexpr const_reverse_iterator rbegin() const noexcept
+            {
+                return const_reverse_iterator(cend());
+            }
+
+            constexpr const_reverse_iterator crbegin() const noexcept
+            {
+                return const_reverse_iterator(cend());
+            }
+
+            constexpr reverse_iterator rend() noexcept
+            {
+                return reverse_iterator(begin());
+            }
+
+            constexpr const_reverse_iterator rend() const noexcept
+            {
+                return const_reverse_iterator(cbegin());
+            }
+
+            constexpr const_reverse_iterator crend() const noexcept
+            {
+                return const_reverse_iterator(cbegin());
+            }
+
+            // Capacity
+            [[nodiscard]] constexpr bool empty() const noexcept
+            {
+                return (m_size == 0) ? true : false;
+            }
+
+            constexpr size_type size() const noexcept
+            {
+                return m_size;
+            }
+
+            constexpr size_type max_size() const noexcept
+            {
+                return std::numeric_limits<size_type>::max();
+            }
+
+            constexpr void reserve(size_type new_cap)
+            {
+                if(new_cap > capacity())
+                {
+                    size_type new_words = words_for(new_cap);
+
+                    // Allocate the new memory, zeroed so unused slots read as zero
+                    word_type* new_data = m_allocator.allocate(new_words);
+                    std::fill(new_data, new_data + new_words, word_type(0));
+
+                    // Copy and deallocate the existing words, if they exist
+                    if(m_data != nullptr)
+                    {
+                        std::copy(m_data, m_data + m_words, new_data);
+                        m_allocator.deallocate(m_data, m_words);
+                    }
+
+                    // Use the new memory
+                    m_data = new_data;
+                    m_words = new_words;
+                }
+                else
+                {
+                    throw std::length_error("New capacity inferior to current capacity");
+                }
+            }
+
+            constexpr size_type capacity() const noexcept
+            {
+                return m_words * elements_per_word;
+            }
+
+            constexpr void shrink_to_fit()
+            {
+                size_type used_words = words_for(m_size);
+
+                if(used_words == m_words)
+                {
+                    return;
+                }
+
+                if(used_words == 0)
+                {
+                    m_allocator.deallocate(m_data, m_words);
+
+                    m_data = nullptr;
+                    m_words = 0;
+                }
+                else
+                {
+                    word_type* new_data = m_allocator.allocate(used_words);
+
+                    std::copy(m_data, m_data + used_words, new_data);
+                    m_allocator.deallocate(m_data, m_words);
+
+                    m_data = new_data;
+                    m_words = used_words;
+                }
+            }
+
+            // Modifiers
+            constexpr void clear() noexcept
+            {
+                std::fill(m_data, m_data + words_for(m_size), word_type(0));
+                m_size = 0;
+            }
+
+            constexpr iterator insert(const_iterator pos, value_type value)
+            {
+                size_type index = pos.m_index;
+
+                insert_at(index, value);
+
+                return begin() + index;
+            }
+
+            constexpr iterator insert(const_iterator pos, size_type count, value_type value)
+            {
+                size_type index = pos.m_index;
+
+                // Allocate memory
+                if(m_size + count > capacity())
+                {
+                    allocate(m_size + count);
+                }
+
+                // Insert values
+                for(size_type i = 0; i < count; ++i)
+                {
+                    insert_at(index + i, value);
+                }
+
+                return begin() + index;
+            }
+
+            template<class InputItr> requires (!std::is_integral_v<InputItr>)
+            constexpr iterator insert(const_iterator pos, InputItr first, InputItr last)
+            {
+                size_type index = pos.m_index;
+
+                // Insert range
+                size_type i = 0;
+                for(InputItr itr = first; itr != last; ++itr)
+                {
+                    insert_at(index + i, static_cast<value_type>(*itr));
+
+                    ++i;
+                }
+
+                return begin() + index;
+            }
+
+            constexpr iterator insert(const_iterator pos, std::initializer_list<value_type> ilist)
+            {
+                size_type index = pos.m_index;
+
+                // Allocate memory
+                if(m_size + ilist.size() > capacity())
+                {
+                    allocate(m_size + ilist.size());
+                }
+
+                // Insert list
+                size_type i = 0;
+                for(value_type value : ilist)
+                {
+                    insert_at(index + i, value);
+
+                    ++i;
+                }
+
+                return begin() + index;
+            }
+
+            template<class... Args>
+            constexpr iterator emplace(const_iterator pos, Args&&... args)
+            {
+                return insert(pos, value_type(std::forward<Args>(args)...));
+            }
+
+            constexpr iterator erase(const_iterator pos)
+            {
+                size_type index = pos.m_index;
+
+                set(index, get(m_size - 1));
+                pop_back();
+
+                return begin() + index;
+            }
+
+            constexpr iterator erase(const_iterator first, const_iterator last)
+            {
+                size_type index = first.m_index;
+                size_type count = last.m_index - first.m_index;
+
+                // Fill the hole with the elements of the tail that lie past it
+                size_type tail = std::max(last.m_index, m_size - count);
+                for(size_type i = tail; i < m_size; ++i)
+                {
+                    set(index + (i - tail), get(i));
+                }
+
+                truncate(m_size - count);
+
+                return begin() + index;
+            }
+
+            constexpr void push_back(value_type value)
+            {
+                // Increase the size
+                if(m_size + 1 > capacity())
+                {
+                    allocate(m_size + 1);
+                }
+
+                set(m_size, value);
+                ++m_size;
+            }
+
+            constexpr reference emplace_back(value_type value)
+            {
+                push_back(value);
+                return back();
+            }
+
+            constexpr void pop_back()
+            {
+                set(m_size - 1, value_type());
+                --m_size;
+            }
+
+            constexpr void resize(size_type count)
+            {
+                if(m_size > count)
+                {
+                    truncate(count);
+                }
+                else if(m_size < count)
+                {
+                    // Unused slots are kept zeroed, so growing is free once the memory exists
+                    if(count > capacity())
+                    {
+                        allocate(count);
+                    }
+
+                    m_size = count;
+                }
+            }
+
+            constexpr void resize(size_type count, value_type value)
+            {
+                if(m_size > count)
+                {
+                    truncate(count);
+                }
+                else if(m_size < count)
+                {
+                    if(count > capacity())
+                    {
+                        allocate(count);
+                    }
+
+                    while(m_size != count)
+                    {
+                        set(m_size++, value);
+                    }
+                }
+            }
+
+            constexpr void swap(packed_unordered_vector& other) noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value || std::allocator_traits<Allocator>::is_always_equal::value)
+            {
+                word_type* data = m_data;
+                size_type size = m_size;
+                size_type words = m_words;
+                allocator_type allocator = m_allocator;
+
+                m_data = other.m_data;
+                m_size = other.m_size;
+                m_words = other.m_words;
+                m_allocator = other.m_allocator;
+
+                other.m_data = data;
+                other.m_size = size;
+                other.m_words = words;
+                other.m_allocator = allocator;
+            }
+
+            // Bulk operations, performed a word at a time
+            constexpr size_type count(value_type value) const noexcept
+            {
+                word_type pattern = broadcast(static_cast<word_type>(value));
+                size_type full_words = m_size / elements_per_word;
+                size_type remaining = m_size % elements_per_word;
+                size_type matches = 0;
+
+                for(size_type i = 0; i < full_words; ++i)
+                {
+                    matches += count_zero_fields(m_data[i] ^ pattern, high_bits);
+                }
+
+                if(remaining != 0)
+                {
+                    word_type valid = (word_type(1) << (remaining * Bits)) - 1;
+                    matches += count_zero_fields(m_data[full_words] ^ pattern, high_bits & valid);
+                }
+
+                return matches;
+            }
+
+            constexpr void fill(value_type value) noexcept
+            {
+                std::fill(m_data, m_data + words_for(m_size), broadcast(static_cast<word_type>(value)));
+                clear_tail();
+            }
+
+            constexpr void flip() noexcept
+            {
+                for(size_type i = 0, words = words_for(m_size); i < words; ++i)
+                {
+                    m_data[i] ^= field_bits;
+                }
+
+                clear_tail();
+            }
+
+            // Other
+            constexpr packed_unordered_vector& operator=(const packed_unordered_vector& other)
+            {
+                if(this != &other)
+                {
+                    packed_unordered_vector copy(other);
+                    swap(copy);
+                }
+
+                return *this;
+            }
+
+            constexpr packed_unordered_vector& operator=(packed_unordered_vector&& other) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || std::allocator_traits<Allocator>::is_always_equal::value)
+            {
+                if(this != &other)
+                {
+                    if(m_data != nullptr)
+                    {
+                        m_allocator.deallocate(m_data, m_words);
+                    }
+
+                    m_allocator = other.m_allocator;
+                    m_size = other.m_size;
+                    m_words = other.m_words;
+                    m_data = other.m_data;
+
+                    other.m_data = nullptr;
+                    other.m_size = 0;
+                    other.m_words = 0;
+                }
+
+                return *this;
+            }
+
+            constexpr packed_unordered_vector& operator=(std::initializer_list<value_type> ilist)
+            {
+                assign(ilist);
+
+                return *this;
+            }
+
+            constexpr void assign(size_type count, value_type value)
+            {
+                clear();
+                if(count > capacity())
+                {
+                    allocate(count);
+                }
+
+                m_size = count;
+                fill(value);
+            }
+
+            template<class InputItr> requires (!std::is_integral_v<InputItr>)
+            constexpr void assign(InputItr first, InputItr last)
+            {
+                clear();
+
+                for(InputItr itr = first; itr != last; ++itr)
+                {
+                    push_back(static_cast<value_type>(*itr));
+                }
+            }
+
+            constexpr void assign(std::initializer_list<value_type> ilist)
+            {
+                clear();
+                if(ilist.size() > capacity())
+                {
+                    allocate(ilist.size());
+                }
+
+                for(value_type value : ilist)
+                {
+                    push_back(value);
+                }
+            }
+
+            constexpr allocator_type get_allocator() const noexcept
+            {
+                return m_allocator;
+            }
+
+        private:
+            static constexpr word_type element_mask = (word_type(1) << Bits) - 1;
+
+            word_type* m_data = nullptr;
+            size_type m_size = 0;
+            size_type m_words = 0;
+            allocator_type m_allocator = allocator_type();
+
+            // Lowest bit of every field
+            static constexpr word_type field_ones = []
+            {
+                word_type word = 0;
+                for(size_type i = 0; i < elements_per_word; ++i)
+                {
+                    word |= word_type(1) << (i * Bits);
+                }
+
+                return word;
+            }();
+
+            static constexpr word_type field_bits = field_ones * element_mask;
+            static constexpr word_type high_bits = field_ones << (Bits - 1);
+            static constexpr word_type low_bits = field_bits & ~high_bits;
+
+            // Repeats value in every field of a word
+            static constexpr word_type broadcast(word_type value) noexcept
+            {
+                return (value & element_mask) * field_ones;
+            }
+
+            // Number of fields selected by high that are zero in diff
+            static constexpr size_type count_zero_fields(word_type diff, word_type high) noexcept
+            {
+                // Adding the low bits carries into the high bit of every non-zero field without crossing fields
+                word_type nonzero = (((diff & low_bits) + low_bits) | diff) & high;
+                return static_cast<size_type>(std::popcount(high) - std::popcount(nonzero));
+            }
+
+            static constexpr size_type word_index(size_type pos) noexcept
+            {
+                return pos / elements_per_word;
+            }
+
+            static constexpr size_type word_shift(size_type pos) noexcept
+            {
+                return (pos % elements_per_word) * Bits;
+            }
+
+            static constexpr size_type words_for(size_type count) noexcept
+            {
+                return (count + elements_per_word - 1) / elements_per_word;
+            }
+
+            constexpr value_type get(size_type pos) const noexcept
+            {
+                return static_cast<value_type>((m_data[word_index(pos)] >> word_shift(pos)) & element_mask);
+            }
+
+            constexpr void set(size_type pos, value_type value) noexcept
+            {
+                reference(m_data + word_index(pos), word_shift(pos)) = value;
+            }
+
+            // Places value at pos, moving the element already there to the tail
+            constexpr void insert_at(size_type pos, value_type value)
+            {
+                if(pos == m_size)
+                {
+                    push_back(value);
+                }
+                else
+                {
+                    push_back(get(pos));
+                    set(pos, value);
+                }
+            }
+
+            // Zeroes the bits past the last element of the last used word
+            constexpr void clear_tail() noexcept
+            {
+                size_type remaining = m_size % elements_per_word;
+                if(remaining != 0)
+                {
+                    m_data[m_size / elements_per_word] &= (word_type(1) << (remaining * Bits)) - 1;
+                }
+            }
+
+            // Drops every element from count onwards
+            constexpr void truncate(size_type count) noexcept
+            {
+                size_type used_words = words_for(m_size);
+
+                m_size = count;
+                clear_tail();
+                std::fill(m_data + words_for(m_size), m_data + used_words, word_type(0));
+            }
+
+            void allocate(size_type size)
+            {
+                if(size > capacity())
+                {
+                    // Get the nearest power of 2
+                    size_type power = 1;
+                    while(power < size)
+                    {
+                        power *= 2;
+                    }
+
+                    // Allocate the memory
+                    reserve(power);
+                }
+            }
+    };
+}
+
+namespace std
+{
+    template<unsigned Bits, class Alloc, class Pred>
+    constexpr typename xcontainer::packed_unordered_vector<Bits, Alloc>::size_type erase_if(xcontainer::packed_unordered_vector<Bits, Alloc>& c, Pred pred)
+    {
+        auto old_size = c.size();
+
+        // Swap-and-pop, re-testing the element moved into the hole
+        for(auto itr = c.begin(); itr != c.end();)
+        {
+            if(pred(static_cast<typename xcontainer::packed_unordered_vector<Bits, Alloc>::value_type>(*itr)))
+            {
+                itr = c.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+
+        return old_size - c.size();
+    }
+
+    template<unsigned Bits, class Alloc, class U>
+    constexpr typename xcontainer::packed_unordered_vector<Bits, Alloc>::size_type erase(xcontainer::packed_unordered_vector<Bits, Alloc>& c, const U& value)
+    {
+        return erase_if(c, [&value](typename xcontainer::packed_unordered_vector<Bits, Alloc>::value_type element) { return element == value; });
+    }
+
+    template<unsigned Bits, class Alloc>
+    constexpr void swap(xcontainer::packed_unordered_vector<Bits, Alloc>& lhs, xcontainer::packed_unordered_vector<Bits, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
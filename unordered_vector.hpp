@@ -7,6 +7,7 @@
 #include <stdexcept> // std::length_error, std::out_of_range
 #include <limits> // std::numeric_limits
 #include <string> // std::to_string
+#include <utility> // std::move, std::swap
 
 namespace xcontainer
 {
@@ -575,6 +576,66 @@ namespace xcontainer
                 other.m_allocator = allocator;
             }
 
+            template<class Pred>
+            constexpr unordered_vector extract_if(Pred pred)
+            {
+                // Move the matching elements to the tail in a single pass
+                size_type kept = m_size;
+                for(size_type i = 0; i < kept;)
+                {
+                    if(pred(m_data[i]))
+                    {
+                        --kept;
+                        std::swap(m_data[i], m_data[kept]);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+
+                // Move the tail into the result with a single allocation
+                unordered_vector extracted(m_allocator);
+                size_type count = m_size - kept;
+                if(count != 0)
+                {
+                    extracted.reserve(count);
+                    std::move(begin() + kept, end(), extracted.begin());
+                    extracted.m_size = count;
+                }
+
+                while(m_size != kept)
+                {
+                    pop_back();
+                }
+
+                return extracted;
+            }
+
+            constexpr void merge(unordered_vector&& other)
+            {
+                if(this == &other)
+                {
+                    return;
+                }
+
+                // Keep the larger buffer, since order does not matter
+                if(other.m_capacity > m_capacity && m_allocator == other.m_allocator)
+                {
+                    swap(other);
+                }
+
+                if(m_size + other.m_size > m_capacity)
+                {
+                    allocate(m_size + other.m_size);
+                }
+
+                std::move(other.begin(), other.end(), end());
+                m_size += other.m_size;
+
+                other.clear();
+            }
+
             // Other
             constexpr unordered_vector& operator=(const unordered_vector& other)
             {